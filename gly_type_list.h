@@ -0,0 +1,253 @@
+/**
+ * @file gly_type_list.h
+ * @short gly_type_list.h
+ * @brief retained display lists for gly_type
+ * @date 2026
+ * @author RodrigoDornelles
+ *
+ * @copyright
+ * This work is free. You can redistribute it and/or modify it under the
+ * terms of the Do What The Fuck You Want To Public License, Version 2,
+ * as published by Sam Hocevar. @n See http://www.wtfpl.net/ for more details.
+ *
+ * @par Features
+ *
+ * @li Record the lines of a text once, relative to its origin
+ * @li Replay at any origin with one add per coordinate
+ * @li Fixed memory, @b 8 bytes per line and at most @b 10 lines per glyph
+ * @li Support standards @b C89 and @b C++98
+ *
+ * @par Example Usage
+ * @code
+ * static signed short list[4 * GLY_TYPE_LIST_BOUND(11)];
+ * unsigned int lines;
+ *
+ * lines = gly_type_list(size, "hello world", list, GLY_TYPE_LIST_BOUND(11));
+ *
+ * while (scrolling && lines <= GLY_TYPE_LIST_BOUND(11)) {
+ *     gly_type_list_draw(x, y--, list, lines, draw_line_func);
+ * }
+ * @endcode
+ */
+
+#ifndef H_GLY_TYPE_LIST
+#define H_GLY_TYPE_LIST
+
+#include "gly_type_render.h"
+
+#if defined(__cplusplus)
+#define GLY_TYPE_LIST_API static inline
+typedef int gly_type_list_int;
+#else
+#define GLY_TYPE_LIST_API
+typedef GLY_TYPE_INT gly_type_list_int;
+#endif
+
+/**
+ * Maximum number of lines to record @c chars glyphs,
+ * each line takes @c 4 elements of @c signed @c short.
+ */
+#define GLY_TYPE_LIST_BOUND(chars) ((chars) * 10)
+
+/**
+ * Returned by @ref gly_type_list when a coordinate does not fit in a
+ * @c signed @c short, that is beyond @c 32767 pixels from the origin.
+ * It is greater than any @c max, so it also reads as a truncated list.
+ */
+#define GLY_TYPE_LIST_RANGE ((unsigned int)-1)
+
+static signed short *gly_type_list_out;
+static unsigned int gly_type_list_max;
+static unsigned int gly_type_list_count;
+static unsigned char gly_type_list_range;
+
+GLY_TYPE_LIST_API void
+gly_type_list_line(gly_type_list_int x1,
+                   gly_type_list_int y1,
+                   gly_type_list_int x2,
+                   gly_type_list_int y2) {
+    signed short *line;
+
+    if (x1 != (gly_type_list_int)(signed short)x1
+        || y1 != (gly_type_list_int)(signed short)y1
+        || x2 != (gly_type_list_int)(signed short)x2
+        || y2 != (gly_type_list_int)(signed short)y2) {
+        gly_type_list_range = 1;
+        gly_type_list_max = 0;
+    }
+
+    if (gly_type_list_count < gly_type_list_max) {
+        line = gly_type_list_out + gly_type_list_count * 4;
+        line[0] = (signed short)x1;
+        line[1] = (signed short)y1;
+        line[2] = (signed short)x2;
+        line[3] = (signed short)y2;
+    }
+
+    gly_type_list_count++;
+}
+
+/**
+ * gly_type_list
+ *
+ * Records the lines of @ref gly_type_render into a display list, with the
+ * coordinates relative to the origin, so it can be drawn anywhere later.
+ *
+ * @param [in]  s     Character size in pixels, as in @ref gly_type_render.
+ * @param [in]  t     Text string to be recorded.
+ * @param [out] list  Buffer with @c 4*max elements, or @c NULL to only count.
+ * @param [in]  max   Maximum number of lines to store, the rest is dropped.
+ *
+ * Optional Parameters:
+ * @param [in]  o     Orientation flags, if @ref GLY_TYPE_ORIENTATION.
+ * @param [in]  len   Maximum length of characters, if @ref GLY_TYPE_SAFE.
+ *
+ * @return number of lines of the text, if greater than @c max the list was
+ * truncated and only @c max lines were stored.
+ * @return @ref GLY_TYPE_LIST_RANGE if the text goes beyond the range of the
+ * list, then the lines stored before that are incomplete.
+ */
+GLY_TYPE_LIST_API unsigned int
+gly_type_list(signed int s,
+#if defined(GLY_TYPE_ORIENTATION)
+              unsigned int o,
+#endif
+              const char *t,
+#if defined(GLY_TYPE_SAFE)
+              signed int len,
+#endif
+              signed short *list,
+              unsigned int max) {
+    gly_type_list_out = list;
+    gly_type_list_max = list == ((void *)0) ? 0 : max;
+    gly_type_list_count = 0;
+    gly_type_list_range = 0;
+
+    gly_type_render((gly_type_list_int)0,
+                    (gly_type_list_int)0,
+                    s,
+#if defined(GLY_TYPE_ORIENTATION)
+                    o,
+#endif
+                    t,
+#if defined(GLY_TYPE_SAFE)
+                    len,
+#endif
+                    gly_type_list_line);
+
+    return gly_type_list_range ? GLY_TYPE_LIST_RANGE : gly_type_list_count;
+}
+
+#if defined(__cplusplus)
+GLY_TYPE_LIST_API unsigned int
+gly_type_list(signed int s,
+              const char *t,
+              signed int len,
+              signed short *list,
+              unsigned int max) {
+    return gly_type_list(s, GLY_TYPE_ROTATE_0, t, len, list, max);
+}
+
+GLY_TYPE_LIST_API unsigned int
+gly_type_list(signed int s,
+              unsigned int o,
+              const char *t,
+              signed short *list,
+              unsigned int max) {
+    return gly_type_list(s, o, t, -1, list, max);
+}
+
+GLY_TYPE_LIST_API unsigned int
+gly_type_list(signed int s,
+              const char *t,
+              signed short *list,
+              unsigned int max) {
+    return gly_type_list(s, GLY_TYPE_ROTATE_0, t, -1, list, max);
+}
+#endif
+
+/**
+ * gly_type_list_draw
+ *
+ * Replays a display list at the origin @c (x, y), calling the line-drawing
+ * function once per line, same output of @ref gly_type_render.
+ *
+ * @param [in] x, y   Origin (in pixels).
+ * @param [in] list   Display list recorded by @ref gly_type_list.
+ * @param [in] lines  Number of lines in the list, the return of
+ *                    @ref gly_type_list only if it is not greater than @c max.
+ * @param [in] fptr   Pointer to a line-drawing function, with the interface:
+ *                    `function(x1, y1, x2, y2)`
+ */
+#if defined(__cplusplus)
+template<typename GLY_TYPE_INT>
+#endif
+GLY_TYPE_LIST_API void
+gly_type_list_draw(GLY_TYPE_INT x,
+                   GLY_TYPE_INT y,
+                   const signed short *list,
+                   unsigned int lines,
+                   void (*const draw_line)(GLY_TYPE_INT,
+                                           GLY_TYPE_INT,
+                                           GLY_TYPE_INT,
+                                           GLY_TYPE_INT)) {
+    const signed short *end;
+
+    if (draw_line == ((void *)0) || list == ((void *)0)) {
+        return;
+    }
+
+    end = list + lines * 4;
+
+    while (list < end) {
+        draw_line(x + list[0], y + list[1], x + list[2], y + list[3]);
+        list += 4;
+    }
+}
+
+/**
+ * gly_type_list_batch
+ *
+ * Replays a display list at the origin @c (x, y) into a buffer of
+ * coordinates, @c x1,y1,x2,y2 per line, ready to upload as a vertex batch.
+ *
+ * @param [in]  x, y   Origin (in pixels).
+ * @param [in]  list   Display list recorded by @ref gly_type_list.
+ * @param [in]  lines  Number of lines in the list, the return of
+ *                     @ref gly_type_list only if it is not greater than @c max.
+ * @param [out] out    Buffer with @c 4*lines elements.
+ *
+ * @return pointer past the last written element, to append more text.
+ */
+#if defined(__cplusplus)
+template<typename GLY_TYPE_INT>
+#endif
+GLY_TYPE_LIST_API GLY_TYPE_INT *
+gly_type_list_batch(GLY_TYPE_INT x,
+                    GLY_TYPE_INT y,
+                    const signed short *list,
+                    unsigned int lines,
+                    GLY_TYPE_INT *out) {
+    const signed short *end;
+
+    if (list == ((void *)0) || out == ((void *)0)) {
+        return out;
+    }
+
+    end = list + lines * 4;
+
+    while (list < end) {
+        out[0] = x + list[0];
+        out[1] = y + list[1];
+        out[2] = x + list[2];
+        out[3] = y + list[3];
+        out += 4;
+        list += 4;
+    }
+
+    return out;
+}
+
+#undef GLY_TYPE_LIST_API
+
+#endif
@@ -0,0 +1,273 @@
+/**
+ * @file gly_type_raster.h
+ * @short gly_type_raster.h
+ * @brief anti-aliased lines and signed distance field atlas for gly_type
+ * @date 2026
+ * @author RodrigoDornelles
+ *
+ * @copyright
+ * This work is free. You can redistribute it and/or modify it under the
+ * terms of the Do What The Fuck You Want To Public License, Version 2,
+ * as published by Sam Hocevar. @n See http://www.wtfpl.net/ for more details.
+ *
+ * @par Features
+ *
+ * @li Coverage line rasterizer to plug into @ref gly_type_render
+ * @li Signed distance field atlas built from the segment lines, not pixels
+ * @li Integer only, no @c libm, support standards @b C89 and @b C++98
+ */
+
+#ifndef H_GLY_TYPE_RASTER
+#define H_GLY_TYPE_RASTER
+
+#include "gly_type_render.h"
+
+#if defined(__cplusplus)
+#define GLY_TYPE_RASTER_API static inline
+typedef int gly_type_raster_int;
+#else
+#define GLY_TYPE_RASTER_API
+typedef GLY_TYPE_INT gly_type_raster_int;
+#endif
+
+/**
+ * Bytes needed by @ref gly_type_sdf_atlas for a given @c cell size,
+ * the atlas is a grid of 16 x 6 cells, one byte per texel.
+ */
+#define GLY_TYPE_SDF_SIZE(cell) (16 * 6 * (cell) * (cell))
+
+GLY_TYPE_RASTER_API unsigned long
+gly_type_isqrt(unsigned long n) {
+    unsigned long r = 0, b = 1UL << 30;
+
+    while (b > n) {
+        b >>= 2;
+    }
+
+    while (b) {
+        if (n >= r + b) {
+            n -= r + b;
+            r = (r >> 1) + b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+
+    return r;
+}
+
+/**
+ * gly_type_aa_line
+ *
+ * Draws a line with anti-aliasing, the coverage of each pixel is estimated
+ * from its distance to the line, so horizontal and vertical lines with the
+ * default weight are as sharp as the aliased ones.
+ *
+ * @param [in] x1, y1  Start point (in pixels).
+ * @param [in] x2, y2  End point (in pixels).
+ * @param [in] w       Stroke weight in pixels, @c 0 is the same as @c 1.
+ * @param [in] plot    Pointer to a pixel function, with the interface:
+ *                     `function(x, y, alpha)`
+ * @n @c alpha goes from @c 1 to @c 255, pixels without coverage are skipped.
+ * @n the weight spreads pixels beyond the endpoints, the ones with negative
+ * coordinates or out of the range of @c GLY_TYPE_INT are skipped, before they
+ * wrap around, any other clipping is up to @c plot.
+ *
+ * @par Example Usage
+ * @code
+ * void draw_line(int x1, int y1, int x2, int y2) {
+ *     gly_type_aa_line(x1, y1, x2, y2, 2, blend_pixel);
+ * }
+ *
+ * gly_type_render(x, y, size, "hello world", draw_line);
+ * @endcode
+ */
+#if defined(__cplusplus)
+template<typename GLY_TYPE_INT>
+#endif
+GLY_TYPE_RASTER_API void
+gly_type_aa_line(GLY_TYPE_INT x1,
+                 GLY_TYPE_INT y1,
+                 GLY_TYPE_INT x2,
+                 GLY_TYPE_INT y2,
+                 unsigned int w,
+                 void (*const plot)(GLY_TYPE_INT,
+                                    GLY_TYPE_INT,
+                                    unsigned char)) {
+    long u1, v1, du, dv, sv, i, j, q, qa, qr, acc, k, e, cov, half, reach;
+    long px, py;
+    unsigned char steep;
+
+    if (plot == ((void *)0)) {
+        return;
+    }
+
+    du = (long)x2 - (long)x1;
+    dv = (long)y2 - (long)y1;
+    steep = (dv < 0 ? -dv : dv) > (du < 0 ? -du : du);
+    u1 = steep ? (long)y1 : (long)x1;
+    v1 = steep ? (long)x1 : (long)y1;
+    du = (steep ? (long)y2 : (long)x2) - u1;
+    dv = (steep ? (long)x2 : (long)y2) - v1;
+
+    if (du < 0) {
+        u1 += du;
+        v1 += dv;
+        du = -du;
+        dv = -dv;
+    }
+
+    sv = dv < 0 ? -1 : 1;
+    dv = dv < 0 ? -dv : dv;
+    half = (w ? w : 1) * 128;
+    qa = du ? dv * 256 / du : 0;
+    qr = du ? dv * 256 % du : 0;
+    k = (1L << 23) / gly_type_isqrt((65536UL + qa * qa) << 14);
+    reach = (half + 128) * 256 / k / 256 + 1;
+    q = 0;
+    acc = 0;
+
+    for (i = -(half >> 8); i <= du + (half >> 8); i++) {
+        if (0 < i && i <= du) {
+            q += qa;
+            acc += qr;
+            if (acc >= du) {
+                q++;
+                acc -= du;
+            }
+        }
+        for (j = (q >> 8) - reach; j <= (q >> 8) + reach; j++) {
+            e = j * 256 - q;
+            cov = half + 128 - (e < 0 ? -e : e) * k / 256;
+            px = steep ? v1 + sv * j : u1 + i;
+            py = steep ? u1 + i : v1 + sv * j;
+            if (cov <= 0 || px < 0 || py < 0
+                || px != (long)(GLY_TYPE_INT)px
+                || py != (long)(GLY_TYPE_INT)py) {
+                continue;
+            }
+            plot((GLY_TYPE_INT)px, (GLY_TYPE_INT)py, cov > 255 ? 255 : cov);
+        }
+    }
+}
+
+static gly_type_raster_int gly_type_sdf_lines[32][4];
+static unsigned char gly_type_sdf_count;
+
+GLY_TYPE_RASTER_API void
+gly_type_sdf_line(gly_type_raster_int x1,
+                  gly_type_raster_int y1,
+                  gly_type_raster_int x2,
+                  gly_type_raster_int y2) {
+    if (gly_type_sdf_count < 32) {
+        gly_type_sdf_lines[gly_type_sdf_count][0] = x1;
+        gly_type_sdf_lines[gly_type_sdf_count][1] = y1;
+        gly_type_sdf_lines[gly_type_sdf_count][2] = x2;
+        gly_type_sdf_lines[gly_type_sdf_count][3] = y2;
+        gly_type_sdf_count++;
+    }
+}
+
+/**
+ * gly_type_sdf_atlas
+ *
+ * Builds a signed distance field atlas of the 95 printable ascii glyphs,
+ * the distances are measured from each texel to the segment lines of
+ * @ref gly_type_render, so one small atlas can be sampled at any size.
+ *
+ * @li the glyph @c c is at column @c (c-32)%16 and row @c (c-32)/16.
+ * @li inside each cell the glyph has @c cell-2*pad texels, @c pad=cell/8.
+ * @li a stroke of half-width @c h texels has its edge at the value
+ * @c 128+(pad/2-h)*128/pad, so @c 128 is a stroke of @c pad texels.
+ *
+ * @param [out] atlas  Buffer with @ref GLY_TYPE_SDF_SIZE bytes, rows are
+ * @c 16*cell bytes wide.
+ * @param [in]  cell   Cell size in texels, from @c 8 to @c 128.
+ *
+ * @par Example Usage
+ * @code
+ * static unsigned char atlas[GLY_TYPE_SDF_SIZE(32)];
+ * gly_type_sdf_atlas(atlas, 32);
+ * @endcode
+ */
+GLY_TYPE_RASTER_API void
+gly_type_sdf_atlas(unsigned char *atlas, unsigned int cell) {
+    char text[2];
+    unsigned char c, l;
+    unsigned int tx, ty;
+    unsigned long d2, best, cr2, l2;
+    long pad, ax, ay, bx, by, t, v;
+    gly_type_raster_int *line;
+    unsigned char *texel;
+
+    if (atlas == ((void *)0) || cell < 8 || cell > 128) {
+        return;
+    }
+
+    pad = cell / 8;
+    text[1] = '\0';
+
+    for (c = 0; c < 96; c++) {
+        text[0] = (char)(c + 0x20);
+        gly_type_sdf_count = 0;
+
+        if (c < 95) {
+#if defined(GLY_TYPE_ORIENTATION)
+            gly_type_render((gly_type_raster_int)pad,
+                            (gly_type_raster_int)pad,
+                            (signed int)(cell - 2 * pad),
+                            GLY_TYPE_ROTATE_0,
+                            text,
+#if defined(GLY_TYPE_SAFE)
+                            -1,
+#endif
+                            gly_type_sdf_line);
+#else
+            gly_type_render((gly_type_raster_int)pad,
+                            (gly_type_raster_int)pad,
+                            (signed int)(cell - 2 * pad),
+                            text,
+#if defined(GLY_TYPE_SAFE)
+                            -1,
+#endif
+                            gly_type_sdf_line);
+#endif
+        }
+
+        for (ty = 0; ty < cell; ty++) {
+            texel = atlas + ((c / 16) * cell + ty) * 16 * cell;
+            texel += (c % 16) * cell;
+            for (tx = 0; tx < cell; tx++) {
+                best = 0xffffffffUL;
+                for (l = 0; l < gly_type_sdf_count; l++) {
+                    line = gly_type_sdf_lines[l];
+                    ax = (long)tx - line[0];
+                    ay = (long)ty - line[1];
+                    bx = (long)line[2] - line[0];
+                    by = (long)line[3] - line[1];
+                    l2 = bx * bx + by * by;
+                    t = ax * bx + ay * by;
+                    if (t <= 0 || l2 == 0) {
+                        d2 = (ax * ax + ay * ay) * 256UL;
+                    } else if ((unsigned long)t >= l2) {
+                        ax -= bx;
+                        ay -= by;
+                        d2 = (ax * ax + ay * ay) * 256UL;
+                    } else {
+                        cr2 = (ax * by - ay * bx) * (ax * by - ay * bx);
+                        d2 = cr2 / l2 * 256 + cr2 % l2 * 256 / l2;
+                    }
+                    best = d2 < best ? d2 : best;
+                }
+                v = 192 * pad - 8 * (long)gly_type_isqrt(best);
+                v = v <= 0 ? 0 : v / pad;
+                texel[tx] = (unsigned char)(v > 255 ? 255 : v);
+            }
+        }
+    }
+}
+
+#undef GLY_TYPE_RASTER_API
+
+#endif
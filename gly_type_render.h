@@ -94,6 +94,10 @@
 #error Do not use GLY_TYPE_INT or GLY_TYPE_SAFE in C++
 #endif
 
+#if defined(__cplusplus) && defined(GLY_TYPE_ORIENTATION)
+#error Do not use GLY_TYPE_ORIENTATION in C++
+#endif
+
 #if !defined(__cplusplus) && !defined(GLY_TYPE_INT)
 /**
  * The @c GLY_TYPE_INT defines the integer type used for coordinates and sizes
@@ -122,8 +126,41 @@
  * access beyond the string's end.
  */
 #define GLY_TYPE_SAFE
+
+/**
+ * @details
+ * The @c GLY_TYPE_ORIENTATION macro enables an orientation parameter in the
+ * @ref gly_type_render function. When defined, glyphs and the advance
+ * direction can be rotated or mirrored with the @c GLY_TYPE_ROTATE_ and
+ * @c GLY_TYPE_MIRROR_ flags, without any scratch buffer.
+ */
+#define GLY_TYPE_ORIENTATION
 #endif
 
+/**
+ * @defgroup orientation Orientation
+ * @details
+ * Flags for the @c o parameter of @ref gly_type_render.
+ * The transform is applied to the glyph geometry before it reaches the
+ * line-drawing function, so horizontal and vertical lines stay axis-aligned.
+ *
+ * @li @c (x, y) is always the top-left corner of the first glyph cell.
+ * @li the text advances right @b 0, down @b 90, left @b 180, up @b 270.
+ * @li mirror flags are applied to the glyph first, combine them with @c ^
+ * @code
+ * gly_type_render(x, y, size, GLY_TYPE_ROTATE_90 ^ GLY_TYPE_MIRROR_H, ...);
+ * @endcode
+ * @{
+ */
+#define GLY_TYPE_MIRROR_H 1
+#define GLY_TYPE_MIRROR_V 2
+#define GLY_TYPE_TRANSPOSE 4
+#define GLY_TYPE_ROTATE_0 0
+#define GLY_TYPE_ROTATE_90 6
+#define GLY_TYPE_ROTATE_180 3
+#define GLY_TYPE_ROTATE_270 5
+/** @} */
+
 /**
  * gly_type_render
  *
@@ -134,18 +171,21 @@
  *
  * @pre If the optional @c len parameter is used,
  * @ref GLY_TYPE_SAFE must be defined with `#define GLY_TYPE_SAFE` prior to
- * including this function.
+ * including this function, the same goes for @c o and
+ * @ref GLY_TYPE_ORIENTATION.
  *
  * @param [in] x      Horizontal coordinate (in pixels).
  * @param [in] y      Vertical coordinate (in pixels).
- * @param [in] size   Character size in pixels.
+ * @param [in] size   Character size in pixels, negative flips vertically.
  * @param [in] text   Text string to be rendered, terminated with a null
  * character (`\0`).
  * @param [in] fptr   Pointer to a line-drawing function, with the interface:
  *                    `function(x1, y1, x2, y2)`
  * @n draws a line from `(x1, y1)` to `(x2, y2)`.
  *
- * Optional Parameter:
+ * Optional Parameters:
+ * @param [in] o      Orientation flags, see @ref orientation, applicable only
+ * if `GLY_TYPE_ORIENTATION` is defined.
  * @param [in] len    Maximum length of characters to process, applicable only
  * if `GLY_TYPE_SAFE` is defined. If `len` is -1, all characters in the string
  * are processed until the null terminator.
@@ -169,6 +209,9 @@ void
 gly_type_render(GLY_TYPE_INT x,
                 GLY_TYPE_INT y,
                 signed int s,
+#if defined(GLY_TYPE_ORIENTATION)
+                unsigned int o,
+#endif
                 const char *t,
 #if defined(GLY_TYPE_SAFE)
                 signed int len,
@@ -211,17 +254,28 @@ gly_type_render(GLY_TYPE_INT x,
     };
 
     unsigned int sabs;
-    unsigned char c, m1, m2, segment;
-    GLY_TYPE_INT sp2, sm1, x1, x2, x3, y1, y2, y3;
+    unsigned char c, m1, m2, segment, flip;
+    GLY_TYPE_INT sp2, sm1, px, x1, x2, x3, y1, y2, y3;
     GLY_TYPE_INT sd4, x2m1, x2p1, y2m1, y2p1, sne1;
 
+#if defined(GLY_TYPE_ORIENTATION)
+#define GLY_TYPE_LINE(a, b, c, d)                                              \
+    (flip & GLY_TYPE_TRANSPOSE ? draw_line(b, a, d, c) : draw_line(a, b, c, d))
+    flip = (o ^ (s < 0 ? GLY_TYPE_MIRROR_V : 0)) & 7;
+    px = flip & GLY_TYPE_TRANSPOSE ? y : x;
+    y1 = flip & GLY_TYPE_TRANSPOSE ? x : y;
+#else
+#define GLY_TYPE_LINE(a, b, c, d) draw_line(a, b, c, d)
+    flip = s < 0 ? GLY_TYPE_MIRROR_V : 0;
+    px = x;
+    y1 = y;
+#endif
+
     sabs = s < 0 ? -s : s;
     sp2 = sabs + 2;
     sm1 = sabs - 1;
     sd4 = sabs / 4;
     sne1 = ~sabs & 1;
-    x1 = x;
-    y1 = y;
     y2 = y1 + (sm1 / 2);
     y3 = y1 + sm1;
 
@@ -229,10 +283,15 @@ gly_type_render(GLY_TYPE_INT x,
         return;
     }
 
-    if (s < 0) {
+    if (flip & GLY_TYPE_MIRROR_V) {
         y3 = y3 ^ y1;
         y1 = y3 ^ y1;
         y3 = y3 ^ y1;
+        y2 = y1 - (sm1 / 2);
+    }
+
+    if (flip & GLY_TYPE_MIRROR_H) {
+        sp2 = -sp2;
     }
 
     while (*t) {
@@ -241,8 +300,15 @@ gly_type_render(GLY_TYPE_INT x,
             break;
         }
 #endif
-        x2 = x1 + (sm1 / 2);
-        x3 = x1 + sm1;
+        x1 = px;
+        x2 = px + (sm1 / 2);
+        x3 = px + sm1;
+
+        if (flip & GLY_TYPE_MIRROR_H) {
+            x1 = x3;
+            x2 = x1 - (sm1 / 2);
+            x3 = px;
+        }
 
         c = *t - 0x20;
 
@@ -259,28 +325,36 @@ gly_type_render(GLY_TYPE_INT x,
             x2p1 = x2 + sd4 + sne1;
             y2m1 = y2 - sd4 + sne1;
             y2p1 = y2 + sd4;
+            if (flip & GLY_TYPE_MIRROR_H) {
+                x2m1 = x2 + sd4;
+                x2p1 = x2 - sd4 - sne1;
+            }
+            if (flip & GLY_TYPE_MIRROR_V) {
+                y2m1 = y2 + sd4 - sne1;
+                y2p1 = y2 - sd4;
+            }
             while (segment < 8) {
                 switch (m1 & (1 << segment) ? segment : 8) {
-                    case 0: draw_line(x1, y2m1, x3, y2m1); break;
-                    case 1: draw_line(x1, y2p1, x3, y2p1); break;
-                    case 2: draw_line(x2, y2, x2, y3); break;
-                    case 3: draw_line(x2, y1, x2, y2p1); break;
+                    case 0: GLY_TYPE_LINE(x1, y2m1, x3, y2m1); break;
+                    case 1: GLY_TYPE_LINE(x1, y2p1, x3, y2p1); break;
+                    case 2: GLY_TYPE_LINE(x2, y2, x2, y3); break;
+                    case 3: GLY_TYPE_LINE(x2, y1, x2, y2p1); break;
                     case 4:
-                        draw_line(x2m1, y1, x2m1, y3);
-                        draw_line(x2p1, y1, x2p1, y3);
+                        GLY_TYPE_LINE(x2m1, y1, x2m1, y3);
+                        GLY_TYPE_LINE(x2p1, y1, x2p1, y3);
                         break;
-                    case 5: draw_line(x2m1, y3, x2p1, y2p1); break;
+                    case 5: GLY_TYPE_LINE(x2m1, y3, x2p1, y2p1); break;
                     case 6:
-                        draw_line(x2p1, y2m1, x2p1, y1);
-                        draw_line(x2m1, y2m1, x2m1, y1);
-                        draw_line(x2m1, y2m1, x2p1, y2m1);
-                        draw_line(x2m1, y1, x2p1, y1);
+                        GLY_TYPE_LINE(x2p1, y2m1, x2p1, y1);
+                        GLY_TYPE_LINE(x2m1, y2m1, x2m1, y1);
+                        GLY_TYPE_LINE(x2m1, y2m1, x2p1, y2m1);
+                        GLY_TYPE_LINE(x2m1, y1, x2p1, y1);
                         break;
                     case 7:
-                        draw_line(x2m1, y2p1, x2p1, y2p1);
-                        draw_line(x2m1, y2p1, x2m1, y3);
-                        draw_line(x2p1, y2p1, x2p1, y3);
-                        draw_line(x2m1, y3, x2p1, y3);
+                        GLY_TYPE_LINE(x2m1, y2p1, x2p1, y2p1);
+                        GLY_TYPE_LINE(x2m1, y2p1, x2m1, y3);
+                        GLY_TYPE_LINE(x2p1, y2p1, x2p1, y3);
+                        GLY_TYPE_LINE(x2m1, y3, x2p1, y3);
                         break;
                 }
                 segment++;
@@ -296,14 +370,14 @@ gly_type_render(GLY_TYPE_INT x,
         segment = 0;
         while (segment < 8) {
             switch (m1 & (1 << segment) ? segment : 8) {
-                case 0: draw_line(x1, y1, x2, y1); break;
-                case 1: draw_line(x2, y1, x3, y1); break;
-                case 2: draw_line(x3, y1, x3, y2); break;
-                case 3: draw_line(x3, y2, x3, y3); break;
-                case 4: draw_line(x2, y3, x3, y3); break;
-                case 5: draw_line(x1, y3, x2, y3); break;
-                case 6: draw_line(x1, y2, x1, y3); break;
-                case 7: draw_line(x1, y1, x1, y2); break;
+                case 0: GLY_TYPE_LINE(x1, y1, x2, y1); break;
+                case 1: GLY_TYPE_LINE(x2, y1, x3, y1); break;
+                case 2: GLY_TYPE_LINE(x3, y1, x3, y2); break;
+                case 3: GLY_TYPE_LINE(x3, y2, x3, y3); break;
+                case 4: GLY_TYPE_LINE(x2, y3, x3, y3); break;
+                case 5: GLY_TYPE_LINE(x1, y3, x2, y3); break;
+                case 6: GLY_TYPE_LINE(x1, y2, x1, y3); break;
+                case 7: GLY_TYPE_LINE(x1, y1, x1, y2); break;
             }
             segment++;
         }
@@ -311,38 +385,40 @@ gly_type_render(GLY_TYPE_INT x,
         segment = 0;
         while (segment < 7) {
             switch (m2 & (1 << segment) ? segment : 7) {
-                case 0: draw_line(x1, y2, x2, y2); break;
-                case 1: draw_line(x2, y2, x3, y2); break;
+                case 0: GLY_TYPE_LINE(x1, y2, x2, y2); break;
+                case 1: GLY_TYPE_LINE(x2, y2, x3, y2); break;
                 case 2:
-                    m2 & 0x3 ? draw_line(x2, y2, x2, m1 & 0x03 ? y1 : y3)
-                             : draw_line(x2, y1, x2, y3);
+                    m2 & 0x3 ? GLY_TYPE_LINE(x2, y2, x2, m1 & 0x03 ? y1 : y3)
+                             : GLY_TYPE_LINE(x2, y1, x2, y3);
                     break;
                 case 3:
-                    m2 & 0x80 ? draw_line(x1, y2, x2, y1)
-                              : draw_line(x1, y1, x2, y2);
+                    m2 & 0x80 ? GLY_TYPE_LINE(x1, y2, x2, y1)
+                              : GLY_TYPE_LINE(x1, y1, x2, y2);
                     break;
                 case 4:
-                    m2 & 0x80 ? draw_line(x2, y1, x3, y2)
-                              : draw_line(x2, y2, x3, y1);
+                    m2 & 0x80 ? GLY_TYPE_LINE(x2, y1, x3, y2)
+                              : GLY_TYPE_LINE(x2, y2, x3, y1);
                     break;
                 case 5:
-                    m2 & 0x80 ? draw_line(x2, y3, x3, y2)
-                              : draw_line(x2, y2, x3, y3);
+                    m2 & 0x80 ? GLY_TYPE_LINE(x2, y3, x3, y2)
+                              : GLY_TYPE_LINE(x2, y2, x3, y3);
                     break;
                 case 6:
-                    m2 & 0x80 ? draw_line(x1, y2, x2, y3)
-                              : draw_line(x1, y3, x2, y2);
+                    m2 & 0x80 ? GLY_TYPE_LINE(x1, y2, x2, y3)
+                              : GLY_TYPE_LINE(x1, y3, x2, y2);
                     break;
             }
             segment++;
         }
 
     gly_type_next_char:
-        x1 += sp2;
+        px += sp2;
 
     gly_type_skip_char:
         t++;
     }
+
+#undef GLY_TYPE_LINE
 }
 
 #if defined(__cplusplus)
@@ -356,7 +432,35 @@ gly_type_render(GLY_TYPE_INT x,
                                         GLY_TYPE_INT,
                                         GLY_TYPE_INT,
                                         GLY_TYPE_INT)) {
-    gly_type_render(x, y, s, t, -1, draw_line);
+    gly_type_render(x, y, s, GLY_TYPE_ROTATE_0, t, -1, draw_line);
+}
+
+template<typename GLY_TYPE_INT>
+void
+gly_type_render(GLY_TYPE_INT x,
+                GLY_TYPE_INT y,
+                signed int s,
+                const char *t,
+                signed int len,
+                void (*const draw_line)(GLY_TYPE_INT,
+                                        GLY_TYPE_INT,
+                                        GLY_TYPE_INT,
+                                        GLY_TYPE_INT)) {
+    gly_type_render(x, y, s, GLY_TYPE_ROTATE_0, t, len, draw_line);
+}
+
+template<typename GLY_TYPE_INT>
+void
+gly_type_render(GLY_TYPE_INT x,
+                GLY_TYPE_INT y,
+                signed int s,
+                unsigned int o,
+                const char *t,
+                void (*const draw_line)(GLY_TYPE_INT,
+                                        GLY_TYPE_INT,
+                                        GLY_TYPE_INT,
+                                        GLY_TYPE_INT)) {
+    gly_type_render(x, y, s, o, t, -1, draw_line);
 }
 #endif
 
@@ -1,3 +1,79 @@
+#include <assert.h>
+
+#include "gly_type_render.h"
+#include "gly_type_raster.h"
+#include "gly_type_list.h"
+
+#if defined(GLY_TYPE_ORIENTATION)
+#define FLIP GLY_TYPE_ROTATE_180,
+#else
+#define FLIP
+#endif
+
+int plot_wrap;
+void plot_test(unsigned char x, unsigned char y, unsigned char a)
+{
+    plot_wrap += x < 240 || y > 16;
+}
+
+unsigned char atlas[GLY_TYPE_SDF_SIZE(16)];
+unsigned char sdf_texel(char glyph, int row, int col)
+{
+    int c = glyph - 0x20;
+    return atlas[((c / 16) * 16 + row) * 16 * 16 + (c % 16) * 16 + col];
+}
+
+signed short list[4 * GLY_TYPE_LIST_BOUND(3)];
+
+unsigned char lines_render[4 * GLY_TYPE_LIST_BOUND(3)];
+unsigned char lines_replay[4 * GLY_TYPE_LIST_BOUND(3)];
+unsigned int lines_render_count, lines_replay_count;
+
+void drawline_render(unsigned char x1,
+                     unsigned char y1,
+                     unsigned char x2,
+                     unsigned char y2)
+{
+    unsigned char *line = &lines_render[4 * lines_render_count++];
+    line[0] = x1;
+    line[1] = y1;
+    line[2] = x2;
+    line[3] = y2;
+}
+
+void drawline_replay(unsigned char x1,
+                     unsigned char y1,
+                     unsigned char x2,
+                     unsigned char y2)
+{
+    unsigned char *line = &lines_replay[4 * lines_replay_count++];
+    line[0] = x1;
+    line[1] = y1;
+    line[2] = x2;
+    line[3] = y2;
+}
+
 int main() {
+    unsigned int i, lines;
+
+    gly_type_aa_line(250, 5, 255, 5, 2, plot_test);
+    gly_type_aa_line(245, 0, 255, 10, 1, plot_test);
+    assert(plot_wrap == 0);
+
+    gly_type_sdf_atlas(atlas, 16);
+    assert(sdf_texel(' ', 0, 0) == 0);
+    assert(sdf_texel('`', 2, 2) == 192);
+    assert(sdf_texel('`', 2, 8) < 128);
+
+    lines = gly_type_list(-17, FLIP "Hi!", list, GLY_TYPE_LIST_BOUND(3));
+    assert(lines > 0 && lines <= GLY_TYPE_LIST_BOUND(3));
+    gly_type_render(100, 40, -17, FLIP "Hi!", drawline_render);
+    gly_type_list_draw(100, 40, list, lines, drawline_replay);
+    assert(lines_render_count == lines);
+    assert(lines_replay_count == lines);
+    for (i = 0; i < 4 * lines; i++) {
+        assert(lines_render[i] == lines_replay[i]);
+    }
+
     return 0;
-}
\ No newline at end of file
+}
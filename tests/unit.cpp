@@ -2,6 +2,8 @@
 #include <assert.h>
 
 #include "gly_type_render.h"
+#include "gly_type_raster.h"
+#include "gly_type_list.h"
 
 #define def_draw_line(T,I) T arr_##T##I[4]; \
     void drawline_##T##I(T a, T b, T c, T d) \
@@ -13,6 +15,73 @@ def_draw_line(int,_test3);
 def_draw_line(uint8_t,_test1);
 def_draw_line(uint8_t,_test2);
 def_draw_line(uint8_t,_test3);
+def_draw_line(int,_test4);
+def_draw_line(int,_test5);
+def_draw_line(int,_test6);
+def_draw_line(int,_test7);
+def_draw_line(int,_test8);
+def_draw_line(int,_test9);
+def_draw_line(int,_test10);
+def_draw_line(int,_test11);
+
+int span_min = 1000, span_max = -1000;
+void drawline_span(int x1, int y1, int x2, int y2)
+{
+    span_min = y1 < span_min ? y1 : span_min;
+    span_min = y2 < span_min ? y2 : span_min;
+    span_max = y1 > span_max ? y1 : span_max;
+    span_max = y2 > span_max ? y2 : span_max;
+}
+
+int plot_count, plot_alpha;
+void plot_test(int x, int y, unsigned char a)
+{
+    plot_count++;
+    plot_alpha += a;
+}
+
+int grid[16][16];
+void plot_grid(int x, int y, unsigned char a)
+{
+    assert(0 <= x && x < 16 && 0 <= y && y < 16);
+    grid[y][x] = a;
+}
+
+int plot_left, plot_wrap;
+void plot_uint8_t(uint8_t x, uint8_t y, unsigned char a)
+{
+    plot_wrap += x < plot_left || x > plot_left + 16 || y > 16;
+}
+
+unsigned char atlas[GLY_TYPE_SDF_SIZE(16)];
+unsigned char sdf_texel(char glyph, int row, int col)
+{
+    int c = glyph - 0x20;
+    return atlas[((c / 16) * 16 + row) * 16 * 16 + (c % 16) * 16 + col];
+}
+
+signed short list[4 * GLY_TYPE_LIST_BOUND(3)];
+int batch[4 * GLY_TYPE_LIST_BOUND(3)];
+
+int lines_render[4 * GLY_TYPE_LIST_BOUND(3)], lines_render_count;
+int lines_replay[4 * GLY_TYPE_LIST_BOUND(3)], lines_replay_count;
+void drawline_render(int x1, int y1, int x2, int y2)
+{
+    int *line = &lines_render[4 * lines_render_count++];
+    line[0] = x1;
+    line[1] = y1;
+    line[2] = x2;
+    line[3] = y2;
+}
+
+void drawline_replay(int x1, int y1, int x2, int y2)
+{
+    int *line = &lines_replay[4 * lines_replay_count++];
+    line[0] = x1;
+    line[1] = y1;
+    line[2] = x2;
+    line[3] = y2;
+}
 
 int main()
 {
@@ -52,5 +121,144 @@ int main()
     assert(arr_uint8_t_test3[2] == 85);
     assert(arr_uint8_t_test3[3] == 75);
 
+    gly_type_render(10, 20, 31, GLY_TYPE_ROTATE_90, "`", drawline_int_test4);
+    assert(arr_int_test4[0] == 40);
+    assert(arr_int_test4[1] == 20);
+    assert(arr_int_test4[2] == 25);
+    assert(arr_int_test4[3] == 35);
+
+    gly_type_render(70, 20, 31, GLY_TYPE_ROTATE_180, "``", drawline_int_test5);
+    assert(arr_int_test5[0] == 67);
+    assert(arr_int_test5[1] == 50);
+    assert(arr_int_test5[2] == 52);
+    assert(arr_int_test5[3] == 35);
+
+    gly_type_render(10, 20, 31, GLY_TYPE_ROTATE_270, "`", 1, drawline_int_test6);
+    assert(arr_int_test6[0] == 10);
+    assert(arr_int_test6[1] == 50);
+    assert(arr_int_test6[2] == 25);
+    assert(arr_int_test6[3] == 35);
+
+    gly_type_render(70, 20, 31, GLY_TYPE_MIRROR_H, "``", drawline_int_test8);
+    assert(arr_int_test8[0] == 67);
+    assert(arr_int_test8[1] == 20);
+    assert(arr_int_test8[2] == 52);
+    assert(arr_int_test8[3] == 35);
+
+    gly_type_render(10, 20, 31, ".", drawline_span);
+    assert(span_min == 42);
+    assert(span_max == 50);
+    span_min = 1000;
+    span_max = -1000;
+    gly_type_render(10, 20, -31, ".", drawline_span);
+    assert(span_min == 20);
+    assert(span_max == 28);
+
+    gly_type_render(0, 0, 8, GLY_TYPE_MIRROR_H, "T", drawline_int_test9);
+    assert(arr_int_test9[0] == 4);
+    assert(arr_int_test9[1] == 0);
+    assert(arr_int_test9[2] == 4);
+    assert(arr_int_test9[3] == 7);
+
+    gly_type_render(0, 0, 8, GLY_TYPE_MIRROR_V, "H", drawline_int_test10);
+    assert(arr_int_test10[0] == 3);
+    assert(arr_int_test10[1] == 4);
+    assert(arr_int_test10[2] == 7);
+    assert(arr_int_test10[3] == 4);
+
+    gly_type_render(0, 0, 8, GLY_TYPE_ROTATE_90, "H", drawline_int_test11);
+    assert(arr_int_test11[0] == 4);
+    assert(arr_int_test11[1] == 3);
+    assert(arr_int_test11[2] == 4);
+    assert(arr_int_test11[3] == 7);
+
+    span_min = 1000;
+    span_max = -1000;
+    gly_type_render(0, 0, -8, ".", drawline_span);
+    assert(span_min == 0);
+    assert(span_max == 2);
+
+    gly_type_aa_line(0, 5, 9, 5, 1, plot_test);
+    assert(plot_count == 10);
+    assert(plot_alpha == 10 * 255);
+
+    gly_type_aa_line(0, 0, 4, 4, 1, plot_grid);
+    assert(grid[0][0] == 255);
+    assert(grid[2][2] == 255);
+    assert(grid[2][3] == 75);
+    assert(grid[3][2] == 75);
+    assert(grid[0][2] == 0);
+
+    gly_type_aa_line(1, 0, 3, 8, 1, plot_grid);
+    assert(grid[0][1] == 255);
+    assert(grid[1][1] == 194);
+    assert(grid[1][2] == 70);
+    assert(grid[2][1] == 132);
+    assert(grid[2][2] == 132);
+    assert(grid[8][3] == 255);
+
+    gly_type_aa_line(0, 10, 6, 10, 2, plot_grid);
+    assert(grid[9][3] == 128);
+    assert(grid[10][3] == 255);
+    assert(grid[11][3] == 128);
+    assert(grid[12][3] == 0);
+    assert(grid[10][7] == 255);
+
+    gly_type_aa_line<uint8_t>(0, 0, 10, 10, 1, plot_uint8_t);
+    gly_type_aa_line<uint8_t>(0, 0, 10, 0, 2, plot_uint8_t);
+    assert(plot_wrap == 0);
+
+    plot_left = 240;
+    gly_type_aa_line<uint8_t>(250, 5, 255, 5, 2, plot_uint8_t);
+    gly_type_aa_line<uint8_t>(245, 0, 255, 10, 1, plot_uint8_t);
+    assert(plot_wrap == 0);
+
+    gly_type_sdf_atlas(atlas, 16);
+    assert(sdf_texel(' ', 0, 0) == 0);
+    assert(sdf_texel('`', 2, 2) == 192);
+    assert(sdf_texel('`', 3, 3) == 192);
+    assert(sdf_texel('`', 2, 8) < 128);
+
+    for (char c = 0x20; c < 0x7f; c++) {
+        char text[2] = {c, 0};
+        assert(gly_type_list(31, text, 0, 0) <= GLY_TYPE_LIST_BOUND(1));
+    }
+
+    assert(gly_type_list(31, "``", list, 1) == 2);
+    assert(gly_type_list(31, "``", list, GLY_TYPE_LIST_BOUND(2)) == 2);
+    gly_type_list_draw(7, 20, list, 2, drawline_int_test7);
+    assert(arr_int_test7[0] == 40);
+    assert(arr_int_test7[1] == 20);
+    assert(arr_int_test7[2] == 55);
+    assert(arr_int_test7[3] == 35);
+
+    assert(gly_type_list_batch(7, 20, list, 2, batch) == batch + 8);
+    assert(batch[4] == 40);
+    assert(batch[5] == 20);
+    assert(batch[6] == 55);
+    assert(batch[7] == 35);
+
+    unsigned int flip = GLY_TYPE_ROTATE_180 ^ GLY_TYPE_MIRROR_V;
+    unsigned int lines = gly_type_list(-17, flip, "Hi!", list, 30);
+    assert(lines > 0 && lines <= GLY_TYPE_LIST_BOUND(3));
+    gly_type_render(90, 40, -17, flip, "Hi!", drawline_render);
+    gly_type_list_draw(90, 40, list, lines, drawline_replay);
+    assert(lines_render_count == (int)lines);
+    assert(lines_replay_count == (int)lines);
+    for (unsigned int i = 0; i < 4 * lines; i++) {
+        assert(lines_render[i] == lines_replay[i]);
+    }
+    assert(lines_render[4 * (lines - 1)] < 90);
+
+    char wide[48];
+    for (int i = 0; i < 47; i++) {
+        wide[i] = 'W';
+    }
+    wide[47] = '\0';
+    assert(gly_type_list(1000, wide, list, GLY_TYPE_LIST_BOUND(3))
+           == GLY_TYPE_LIST_RANGE);
+    assert(gly_type_list(1000, wide, 32, list, GLY_TYPE_LIST_BOUND(3))
+           != GLY_TYPE_LIST_RANGE);
+
     return 0;
 }
@@ -0,0 +1,563 @@
+#include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <array>
+#include <map>
+#include <ranges>
+#include <string>
+#include <algorithm>
+
+#include "gly_type_render.h"
+
+struct Point {
+    double x, y;
+};
+
+struct Edge {
+    std::array<int32_t, 2> from, to;
+};
+
+using Quad = std::array<Point, 4>;
+using Contour = std::vector<std::array<int32_t, 2>>;
+
+struct Glyph {
+    std::vector<Contour> contours;
+    int16_t xMin{0}, yMin{0}, xMax{0}, yMax{0};
+    uint16_t points{0};
+};
+
+enum { outside, inside, same, opposite };
+
+constexpr double eps = 1e-6;
+constexpr uint16_t units_per_em = 1000;
+constexpr uint16_t advance = 800;
+constexpr int16_t ascender = 800;
+constexpr int16_t descender = -50;
+constexpr uint64_t mac_epoch = 2082844800;
+constexpr uint64_t release_date = 1737244800;
+const std::string family = "Gamely MonoRetro";
+
+static std::vector<Quad> strokes;
+static double offset;
+
+static const std::map<int, std::string> weight_names = {
+    {100, "Thin"}, {200, "ExtraLight"}, {300, "Light"},
+    {400, "Regular"}, {500, "Medium"}, {600, "SemiBold"},
+    {700, "Bold"}, {800, "ExtraBold"}, {900, "Black"}
+};
+
+void draw_line(int x1, int y1, int x2, int y2)
+{
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double len = std::hypot(dx, dy);
+
+    if (len == 0) {
+        return;
+    }
+
+    double nx = -dy / len * offset;
+    double ny = dx / len * offset;
+    strokes.push_back({{
+        {x1 + nx, y1 + ny}, {x2 + nx, y2 + ny},
+        {x2 - nx, y2 - ny}, {x1 - nx, y1 - ny}
+    }});
+}
+
+static double side(Point a, Point b, Point p)
+{
+    return ((b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x))
+        / std::hypot(b.x - a.x, b.y - a.y);
+}
+
+static int classify(const Quad &quad, Point p, Point dir)
+{
+    int result = inside;
+    for (size_t i = 0; i < quad.size(); i++) {
+        Point a = quad[i];
+        Point b = quad[(i + 1) % quad.size()];
+        double s = side(a, b, p);
+        if (s > eps) {
+            return outside;
+        }
+        if (s > -eps) {
+            double dot = dir.x * (b.x - a.x) + dir.y * (b.y - a.y);
+            result = dot > 0 ? same : opposite;
+        }
+    }
+    return result;
+}
+
+static std::vector<Edge> union_edges()
+{
+    std::vector<Edge> edges;
+
+    for (size_t i = 0; i < strokes.size(); i++) {
+        for (size_t e = 0; e < 4; e++) {
+            Point a = strokes[i][e];
+            Point b = strokes[i][(e + 1) % 4];
+            Point r = {b.x - a.x, b.y - a.y};
+            std::vector<double> cuts = {0.0, 1.0};
+
+            for (size_t j = 0; j < strokes.size(); j++) {
+                for (size_t f = 0; j != i && f < 4; f++) {
+                    Point c = strokes[j][f];
+                    Point d = strokes[j][(f + 1) % 4];
+                    Point s = {d.x - c.x, d.y - c.y};
+                    Point ac = {c.x - a.x, c.y - a.y};
+                    double den = r.x * s.y - r.y * s.x;
+                    if (std::abs(side(a, b, c)) < eps && std::abs(side(a, b, d)) < eps) {
+                        double rr = r.x * r.x + r.y * r.y;
+                        cuts.push_back((ac.x * r.x + ac.y * r.y) / rr);
+                        cuts.push_back(((d.x - a.x) * r.x + (d.y - a.y) * r.y) / rr);
+                    } else if (den != 0) {
+                        double t = (ac.x * s.y - ac.y * s.x) / den;
+                        double u = (ac.x * r.y - ac.y * r.x) / den;
+                        if (u > -eps && u < 1 + eps) {
+                            cuts.push_back(t);
+                        }
+                    }
+                }
+            }
+
+            std::erase_if(cuts, [](double t) { return t < 0 || t > 1; });
+            std::ranges::sort(cuts);
+
+            for (size_t k = 1; k < cuts.size(); k++) {
+                if (cuts[k] - cuts[k - 1] < eps) {
+                    continue;
+                }
+                double tm = (cuts[k] + cuts[k - 1]) / 2;
+                Point m = {a.x + r.x * tm, a.y + r.y * tm};
+                bool keep = true;
+                for (size_t j = 0; keep && j < strokes.size(); j++) {
+                    int where = j == i ? outside : classify(strokes[j], m, r);
+                    keep = where == outside || (where == same && j > i);
+                }
+                if (keep) {
+                    edges.push_back({
+                        {int32_t(std::lround(a.x + r.x * cuts[k - 1])),
+                         int32_t(std::lround(a.y + r.y * cuts[k - 1]))},
+                        {int32_t(std::lround(a.x + r.x * cuts[k])),
+                         int32_t(std::lround(a.y + r.y * cuts[k]))}
+                    });
+                }
+            }
+        }
+    }
+
+    std::erase_if(edges, [](const Edge &e) { return e.from == e.to; });
+    return edges;
+}
+
+static int64_t turn(const Contour &c, size_t i)
+{
+    auto &a = c[(i + c.size() - 1) % c.size()];
+    auto &b = c[i];
+    auto &d = c[(i + 1) % c.size()];
+    return int64_t(b[0] - a[0]) * (d[1] - b[1]) - int64_t(b[1] - a[1]) * (d[0] - b[0]);
+}
+
+static Glyph build_glyph(const std::string &text, size_t index)
+{
+    Glyph glyph;
+    std::vector<Edge> edges;
+    std::multimap<std::array<int32_t, 2>, size_t> starts;
+    std::vector<bool> used;
+
+    strokes.clear();
+    gly_type_render<int>(100, 15, -600, &text[index], 1, draw_line);
+    edges = union_edges();
+    used.resize(edges.size(), false);
+
+    for (size_t i = 0; i < edges.size(); i++) {
+        starts.insert({edges[i].from, i});
+    }
+
+    for (size_t i = 0; i < edges.size(); i++) {
+        Contour contour;
+        size_t e = i;
+        while (!used[e]) {
+            used[e] = true;
+            contour.push_back(edges[e].from);
+            auto [begin, end] = starts.equal_range(edges[e].to);
+            auto next = std::find_if(begin, end, [&](auto &s) { return !used[s.second]; });
+            if (next == end) {
+                break;
+            }
+            e = next->second;
+        }
+
+        for (size_t k = 0; contour.size() >= 3 && k < contour.size();) {
+            if (turn(contour, k) == 0) {
+                contour.erase(contour.begin() + k);
+                k = 0;
+            } else {
+                k++;
+            }
+        }
+
+        if (contour.size() >= 3) {
+            glyph.contours.push_back(contour);
+        }
+    }
+
+    for (auto &contour : glyph.contours) {
+        for (auto &p : contour) {
+            bool first = glyph.points++ == 0;
+            glyph.xMin = first ? p[0] : std::min<int16_t>(glyph.xMin, p[0]);
+            glyph.yMin = first ? p[1] : std::min<int16_t>(glyph.yMin, p[1]);
+            glyph.xMax = first ? p[0] : std::max<int16_t>(glyph.xMax, p[0]);
+            glyph.yMax = first ? p[1] : std::max<int16_t>(glyph.yMax, p[1]);
+        }
+    }
+
+    return glyph;
+}
+
+static void put16(std::vector<uint8_t> &out, uint16_t value)
+{
+    out.push_back(value >> 8);
+    out.push_back(value & 0xff);
+}
+
+static void put32(std::vector<uint8_t> &out, uint32_t value)
+{
+    put16(out, value >> 16);
+    put16(out, value & 0xffff);
+}
+
+static uint32_t checksum(const std::vector<uint8_t> &data)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < data.size(); i += 4) {
+        uint32_t word = 0;
+        for (size_t j = 0; j < 4; j++) {
+            word = (word << 8) | (i + j < data.size() ? data[i + j] : 0);
+        }
+        sum += word;
+    }
+    return sum;
+}
+
+static std::vector<uint8_t> encode_glyph(const Glyph &glyph)
+{
+    std::vector<uint8_t> out, flags, xs, ys;
+    int32_t x = 0, y = 0;
+    uint16_t last = 0;
+
+    if (glyph.contours.empty()) {
+        return out;
+    }
+
+    put16(out, glyph.contours.size());
+    put16(out, glyph.xMin);
+    put16(out, glyph.yMin);
+    put16(out, glyph.xMax);
+    put16(out, glyph.yMax);
+
+    for (auto &contour : glyph.contours) {
+        last += contour.size();
+        put16(out, last - 1);
+        for (auto &p : contour) {
+            int32_t dx = p[0] - x;
+            int32_t dy = p[1] - y;
+            uint8_t flag = 0x01;
+            if (dx == 0) {
+                flag |= 0x10;
+            } else if (std::abs(dx) < 256) {
+                flag |= 0x02 | (dx > 0 ? 0x10 : 0);
+                xs.push_back(std::abs(dx));
+            } else {
+                put16(xs, dx);
+            }
+            if (dy == 0) {
+                flag |= 0x20;
+            } else if (std::abs(dy) < 256) {
+                flag |= 0x04 | (dy > 0 ? 0x20 : 0);
+                ys.push_back(std::abs(dy));
+            } else {
+                put16(ys, dy);
+            }
+            flags.push_back(flag);
+            x = p[0];
+            y = p[1];
+        }
+    }
+
+    put16(out, 0);
+    out.insert(out.end(), flags.begin(), flags.end());
+    out.insert(out.end(), xs.begin(), xs.end());
+    out.insert(out.end(), ys.begin(), ys.end());
+    out.resize((out.size() + 3) & ~3, 0);
+    return out;
+}
+
+static std::vector<uint8_t> encode_name(const std::map<uint16_t, std::string> &names)
+{
+    std::vector<uint8_t> out, strings;
+
+    put16(out, 0);
+    put16(out, names.size());
+    put16(out, 6 + 12 * names.size());
+
+    for (auto &[id, text] : names) {
+        put16(out, 3);
+        put16(out, 1);
+        put16(out, 0x409);
+        put16(out, id);
+        put16(out, text.size() * 2);
+        put16(out, strings.size());
+        for (char c : text) {
+            put16(strings, static_cast<uint8_t>(c));
+        }
+    }
+
+    out.insert(out.end(), strings.begin(), strings.end());
+    return out;
+}
+
+static bool write_font(const std::string &filename, int weight, const std::vector<Glyph> &glyphs)
+{
+    std::map<std::string, std::vector<uint8_t>> tables;
+    std::vector<uint8_t> font;
+    const auto name = weight_names.at(weight);
+    const bool ribbi = weight == 400 || weight == 700;
+    const int16_t stroke = static_cast<int16_t>(offset * 2);
+    int16_t xMin = 0, yMin = 0, xMax = 0, yMax = 0;
+    int16_t minLsb = 0, minRsb = 0;
+    uint16_t maxPoints = 0, maxContours = 0;
+    uint64_t timestamp = release_date + mac_epoch;
+    bool first = true;
+
+    if (const char *epoch = std::getenv("SOURCE_DATE_EPOCH")) {
+        timestamp = std::strtoull(epoch, nullptr, 10) + mac_epoch;
+    }
+
+    for (auto &glyph : glyphs) {
+        if (glyph.contours.empty()) {
+            continue;
+        }
+        xMin = first ? glyph.xMin : std::min(xMin, glyph.xMin);
+        yMin = first ? glyph.yMin : std::min(yMin, glyph.yMin);
+        xMax = first ? glyph.xMax : std::max(xMax, glyph.xMax);
+        yMax = first ? glyph.yMax : std::max(yMax, glyph.yMax);
+        minLsb = first ? glyph.xMin : std::min(minLsb, glyph.xMin);
+        minRsb = std::min<int16_t>(first ? advance : minRsb, advance - glyph.xMax);
+        first = false;
+        maxPoints = std::max(maxPoints, glyph.points);
+        maxContours = std::max<uint16_t>(maxContours, glyph.contours.size());
+    }
+
+    auto &glyf = tables["glyf"];
+    auto &loca = tables["loca"];
+    auto &hmtx = tables["hmtx"];
+    for (auto &glyph : glyphs) {
+        auto data = encode_glyph(glyph);
+        put32(loca, glyf.size());
+        put16(hmtx, advance);
+        put16(hmtx, glyph.xMin);
+        glyf.insert(glyf.end(), data.begin(), data.end());
+    }
+    put32(loca, glyf.size());
+
+    auto &cmap = tables["cmap"];
+    put16(cmap, 0);
+    put16(cmap, 2);
+    for (uint16_t platform : {0, 3}) {
+        put16(cmap, platform);
+        put16(cmap, platform ? 1 : 3);
+        put32(cmap, 20);
+    }
+    for (uint16_t value : {4, 32, 0, 4, 4, 1, 0, 0x7e, 0xffff, 0, 0x20, 0xffff}) {
+        put16(cmap, value);
+    }
+    for (uint16_t value : {uint16_t(1 - 0x20), uint16_t(1), uint16_t(0), uint16_t(0)}) {
+        put16(cmap, value);
+    }
+
+    auto &head = tables["head"];
+    put32(head, 0x00010000);
+    put32(head, 0x00003333);
+    put32(head, 0);
+    put32(head, 0x5f0f3cf5);
+    put16(head, 0x0009);
+    put16(head, units_per_em);
+    for (int i = 0; i < 2; i++) {
+        put32(head, timestamp >> 32);
+        put32(head, timestamp & 0xffffffff);
+    }
+    put16(head, xMin);
+    put16(head, yMin);
+    put16(head, xMax);
+    put16(head, yMax);
+    put16(head, weight == 700 ? 1 : 0);
+    put16(head, 8);
+    put16(head, 2);
+    put16(head, 1);
+    put16(head, 0);
+
+    auto &hhea = tables["hhea"];
+    put32(hhea, 0x00010000);
+    put16(hhea, ascender);
+    put16(hhea, descender);
+    put16(hhea, 0);
+    put16(hhea, advance);
+    put16(hhea, minLsb);
+    put16(hhea, minRsb);
+    put16(hhea, xMax);
+    put16(hhea, 1);
+    put16(hhea, 0);
+    put16(hhea, 0);
+    put32(hhea, 0);
+    put32(hhea, 0);
+    put16(hhea, 0);
+    put16(hhea, glyphs.size());
+
+    auto &maxp = tables["maxp"];
+    put32(maxp, 0x00010000);
+    put16(maxp, glyphs.size());
+    put16(maxp, maxPoints);
+    put16(maxp, maxContours);
+    for (uint16_t value : {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0}) {
+        put16(maxp, value);
+    }
+
+    auto &os2 = tables["OS/2"];
+    put16(os2, 4);
+    put16(os2, advance);
+    put16(os2, weight);
+    put16(os2, 5);
+    put16(os2, 0);
+    for (uint16_t value : {650, 600, 0, 75, 650, 600, 0, 350}) {
+        put16(os2, value);
+    }
+    put16(os2, stroke);
+    put16(os2, 300);
+    put16(os2, 0);
+    os2.insert(os2.end(), {2, 0, uint8_t(weight / 100 + 1), 9, 0, 0, 0, 0, 0, 0});
+    put32(os2, 1);
+    put32(os2, 0);
+    put32(os2, 0);
+    put32(os2, 0);
+    os2.insert(os2.end(), {'N', 'O', 'N', 'E'});
+    put16(os2, (weight == 700 ? 0x20 : ribbi ? 0x40 : 0) | 0x80);
+    put16(os2, 0x20);
+    put16(os2, 0x7e);
+    put16(os2, ascender);
+    put16(os2, descender);
+    put16(os2, 0);
+    put16(os2, std::max<int16_t>(ascender, yMax));
+    put16(os2, std::max<int16_t>(-descender, -yMin));
+    put32(os2, 1);
+    put32(os2, 0);
+    put16(os2, glyphs['x' - 0x1f].yMax);
+    put16(os2, glyphs['H' - 0x1f].yMax);
+    put16(os2, 0);
+    put16(os2, 0x20);
+    put16(os2, 1);
+
+    auto &post = tables["post"];
+    put32(post, 0x00030000);
+    put32(post, 0);
+    put16(post, -75);
+    put16(post, stroke);
+    put32(post, 1);
+    for (int i = 0; i < 4; i++) {
+        put32(post, 0);
+    }
+
+    std::map<uint16_t, std::string> names = {
+        {1, ribbi ? family : family + " " + name},
+        {2, ribbi ? name : "Regular"},
+        {3, family + " " + name + " 0.2"},
+        {4, family + " " + name},
+        {5, "Version 0.2"},
+        {6, "GamelyMonoRetro-" + name}
+    };
+    if (!ribbi) {
+        names[16] = family;
+        names[17] = name;
+    }
+    tables["name"] = encode_name(names);
+
+    uint16_t selector = 0;
+    while ((2u << selector) <= tables.size()) {
+        selector++;
+    }
+
+    put32(font, 0x00010000);
+    put16(font, tables.size());
+    put16(font, 16 << selector);
+    put16(font, selector);
+    put16(font, tables.size() * 16 - (16 << selector));
+
+    uint32_t table_offset = 12 + 16 * tables.size();
+    for (auto &[tag, data] : tables) {
+        font.insert(font.end(), tag.begin(), tag.end());
+        put32(font, checksum(data));
+        put32(font, table_offset);
+        put32(font, data.size());
+        table_offset += (data.size() + 3) & ~3;
+    }
+
+    uint32_t head_offset = 0;
+    for (auto &[tag, data] : tables) {
+        head_offset = tag == "head" ? font.size() : head_offset;
+        font.insert(font.end(), data.begin(), data.end());
+        font.resize((font.size() + 3) & ~3, 0);
+    }
+
+    uint32_t adjustment = 0xb1b0afba - checksum(font);
+    for (int i = 0; i < 4; i++) {
+        font[head_offset + 8 + i] = adjustment >> (24 - 8 * i);
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(font.data()), font.size());
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    const auto ascii = std::views::iota(0x20, 0x7f);
+    const auto text = std::string(ascii.begin(), ascii.end());
+    std::vector<int> weights;
+
+    for (int i = 1; i < argc; i++) {
+        weights.push_back(std::atoi(argv[i]));
+        if (!weight_names.contains(weights.back())) {
+            std::cerr << "weight must be 100, 200, ... 900!" << std::endl;
+            return 1;
+        }
+    }
+
+    if (weights.empty()) {
+        weights.push_back(400);
+    }
+
+    for (int weight : weights) {
+        std::vector<Glyph> glyphs(1);
+        std::string filename = weight == 400
+            ? "font.ttf"
+            : "font-" + std::to_string(weight) + ".ttf";
+
+        offset = 16.0 * weight / 400;
+
+        for (size_t i = 0; i < text.size(); i++) {
+            glyphs.push_back(build_glyph(text, i));
+        }
+
+        if (!write_font(filename, weight, glyphs)) {
+            std::cerr << "error creating font file!" << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}